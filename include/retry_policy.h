@@ -0,0 +1,88 @@
+#ifndef IRIDIUM_SATELLITE_COMM_RETRY_POLICY_H
+#define IRIDIUM_SATELLITE_COMM_RETRY_POLICY_H
+
+#include <stdint.h>
+
+// ===== Retry / back-off policy =====
+// Delay between failed sendReceiveSBDBinary() calls in loop().
+// Pure integer math with no Arduino calls, so tools/fleet_sim can link the
+// exact same logic on the host and evaluate policies across a whole fleet.
+
+static constexpr uint32_t RETRY_DELAY_MS = 10000UL; // keep FAIL shown during this delay
+static constexpr uint32_t RETRY_CAP_MS   = 300000UL; // upper bound for growing policies
+
+enum class RetryPolicyKind : uint8_t {
+  FIXED,                // baseMs every time (original firmware behaviour)
+  EXPONENTIAL,          // baseMs * 2^attempt, capped
+  FULL_JITTER,          // uniform [0, baseMs * 2^attempt], capped
+  DECORRELATED_JITTER   // uniform [baseMs, prev * 3], capped
+};
+
+struct RetryPolicy {
+  RetryPolicyKind kind;
+  uint32_t baseMs;
+  uint32_t capMs;
+};
+
+static constexpr RetryPolicy RETRY_POLICY_DEFAULT = { RetryPolicyKind::FIXED, RETRY_DELAY_MS, RETRY_CAP_MS };
+
+static inline const char* retryPolicyToStr(const RetryPolicyKind kind) {
+  switch (kind) {
+    case RetryPolicyKind::FIXED:               return "fixed";
+    case RetryPolicyKind::EXPONENTIAL:         return "exponential";
+    case RetryPolicyKind::FULL_JITTER:         return "full-jitter";
+    case RetryPolicyKind::DECORRELATED_JITTER: return "decorrelated";
+    default:                                   return "unknown";
+  }
+}
+
+// xorshift32: tiny, deterministic, good enough to de-synchronise units.
+// State must be non-zero; seed it with something that differs per unit.
+static inline uint32_t retryRandNext(uint32_t &state) {
+  if (state == 0) state = 0x9E3779B9UL;
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+// Uniform in [lo, hi] (inclusive)
+static inline uint32_t retryRandRange(uint32_t &state, const uint32_t lo, const uint32_t hi) {
+  if (hi <= lo) return lo;
+  const uint64_t span = static_cast<uint64_t>(hi - lo) + 1;
+  return lo + static_cast<uint32_t>((static_cast<uint64_t>(retryRandNext(state)) * span) >> 32);
+}
+
+// baseMs * 2^attempt without overflowing, clamped to capMs
+static inline uint32_t retryBackoffCeilingMs(const RetryPolicy &p, const uint32_t attempt) {
+  uint32_t d = p.baseMs;
+  for (uint32_t i = 0; i < attempt && d < p.capMs; ++i) {
+    d = (d > p.capMs / 2) ? p.capMs : d * 2;
+  }
+  return (d > p.capMs) ? p.capMs : d;
+}
+
+// Delay before the next try.
+//   attempt     = 0 for the wait after the first failed send, 1 after the second, ...
+//   prevDelayMs = value this function returned last time (0 on the first failure)
+//   rng         = per-unit xorshift32 state (unused by FIXED / EXPONENTIAL)
+static inline uint32_t retryDelayMs(const RetryPolicy &p, const uint32_t attempt,
+                                    const uint32_t prevDelayMs, uint32_t &rng) {
+  switch (p.kind) {
+    case RetryPolicyKind::EXPONENTIAL:
+      return retryBackoffCeilingMs(p, attempt);
+    case RetryPolicyKind::FULL_JITTER:
+      return retryRandRange(rng, 0, retryBackoffCeilingMs(p, attempt));
+    case RetryPolicyKind::DECORRELATED_JITTER: {
+      const uint32_t prev = (prevDelayMs < p.baseMs) ? p.baseMs : prevDelayMs;
+      const uint64_t hi64 = static_cast<uint64_t>(prev) * 3;
+      const uint32_t hi   = (hi64 > p.capMs) ? p.capMs : static_cast<uint32_t>(hi64);
+      return retryRandRange(rng, (p.baseMs > hi) ? hi : p.baseMs, hi);
+    }
+    case RetryPolicyKind::FIXED:
+    default:
+      return p.baseMs;
+  }
+}
+
+#endif //IRIDIUM_SATELLITE_COMM_RETRY_POLICY_H
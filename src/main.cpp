@@ -3,6 +3,7 @@
 #include <IridiumSBD.h>
 #include "../include/config.h"
 #include "../include/print_functions.h"
+#include "../include/retry_policy.h"
 
 // =========================
 // Buttons (active-LOW to GND)
@@ -13,7 +14,7 @@ static constexpr int BTN_SOS   = 8;   // D8 → GND sends "SOS"
 // =========================
 // Timing
 // =========================
-static constexpr unsigned long RETRY_DELAY_MS   = 10000UL; // keep FAIL shown during this delay
+static constexpr RetryPolicy   RETRY_POLICY     = RETRY_POLICY_DEFAULT; // see retry_policy.h (shared with tools/fleet_sim)
 static constexpr unsigned long SUCCESS_HOLD_MS  = 10000UL; // green hold after success
 static constexpr unsigned long WAIT_BLINK_MS    = 250UL;   // yellow blink period
 
@@ -49,6 +50,9 @@ static bool lastAlert = true; // pullup idle HIGH
 static bool lastSOS   = true;
 static unsigned long lastBounceMs = 0;
 
+// Per-unit jitter state for retryDelayMs() (seeded on first button press)
+static uint32_t retryRng = 0;
+
 // =========================
 // RockBLOCK on Serial1 (UART0: TX=D0, RX=D1)
 // =========================
@@ -392,28 +396,38 @@ void loop() {
     if (edgePressed(curAlert, lastAlert)) {
       static uint retryCountAlert = 0;
       SerialMon.println("ALERT button pressed.");
+      if (retryRng == 0) retryRng = micros() | 1UL;
+      uint32_t attempt = 0, retryDelay = 0;
       while (true) {
         if (sendTextWithIndicators("ALERT")) break; // if OK (success)
+        retryDelay = retryDelayMs(RETRY_POLICY, attempt++, retryDelay, retryRng);
         SerialMon.print("Retry count ");
         SerialMon.print(retryCountAlert++);
-        SerialMon.println(".\tRetrying after delay...\n\n");
+        SerialMon.print(".\tRetrying after ");
+        SerialMon.print(retryDelay);
+        SerialMon.println(" ms...\n\n");
         const unsigned long t0 = millis();
         pixelSetMode(MODE_FAIL); // red during wait
-        while (millis() - t0 < RETRY_DELAY_MS) { delay(10); }
+        while (millis() - t0 < retryDelay) { delay(10); }
       }
     }
 
     if (edgePressed(curSOS, lastSOS)) {
       static uint retryCountSOS = 0;
       SerialMon.println("SOS button pressed.");
+      if (retryRng == 0) retryRng = micros() | 1UL;
+      uint32_t attempt = 0, retryDelay = 0;
       while (true) {
         if (sendTextWithIndicators("SOS")) break;   // if OK (success)
+        retryDelay = retryDelayMs(RETRY_POLICY, attempt++, retryDelay, retryRng);
         SerialMon.print("Retry count ");
         SerialMon.print(retryCountSOS++);
-        SerialMon.println(".\tRetrying after delay...\n\n");
+        SerialMon.print(".\tRetrying after ");
+        SerialMon.print(retryDelay);
+        SerialMon.println(" ms...\n\n");
         const unsigned long t0 = millis();
         pixelSetMode(MODE_FAIL);
-        while (millis() - t0 < RETRY_DELAY_MS) { delay(10); }
+        while (millis() - t0 < retryDelay) { delay(10); }
       }
     }
     lastBounceMs = now;
@@ -0,0 +1,125 @@
+#include <unity.h>
+#include "../../tools/fleet_sim/fleet_sim.h"
+
+// Run with: pio test -e native
+
+void setUp() {}
+void tearDown() {}
+
+// Small but busy scenario: drill burst, few channels, short send timeout
+static SimConfig smallConfig() {
+  SimConfig cfg;
+  cfg.devices = 400;
+  cfg.cells = 8;
+  cfg.channelsPerCell = 3;
+  cfg.hours = 4.0;
+  cfg.drillAtH = 1.0;
+  cfg.sendTimeoutS = 60.0;
+  cfg.threads = 1;
+  return cfg;
+}
+
+static void test_gateway_serialises_same_ms_deliveries() {
+  SimConfig cfg;
+  cfg.gatewayRate = 1.0;
+  cfg.gatewayMinS = 0.5;
+
+  Stats st;
+  st.deliveries.push_back({ 5000, 1000, false });
+  st.deliveries.push_back({ 5000, 1000, true });
+  runGateway(cfg, st);
+
+  TEST_ASSERT_EQUAL_UINT32(2, st.latency.size());
+  TEST_ASSERT_EQUAL_UINT32(1, st.drillLatency.size());
+  TEST_ASSERT_EQUAL_FLOAT(5.5, st.latency[0]);  // 4 s to SBDIX success + 1 s service + 0.5 s transit
+  TEST_ASSERT_EQUAL_FLOAT(1.0, st.latency[1] - st.latency[0]);
+}
+
+static void test_gateway_idle_adds_no_queueing() {
+  SimConfig cfg;
+  cfg.gatewayRate = 1.0;
+  cfg.gatewayMinS = 0.0;
+
+  Stats st;
+  st.deliveries.push_back({ 60000, 0, false });
+  st.deliveries.push_back({ 10000, 0, false });  // out of order on purpose
+  runGateway(cfg, st);
+
+  TEST_ASSERT_EQUAL_FLOAT(11.0, st.latency[0]);
+  TEST_ASSERT_EQUAL_FLOAT(61.0, st.latency[1]);
+}
+
+static void test_percentile_nearest_rank() {
+  std::vector<float> v = { 5, 1, 3, 2, 4 };
+  TEST_ASSERT_EQUAL_FLOAT(1, percentile(v, 0.0));
+  TEST_ASSERT_EQUAL_FLOAT(1, percentile(v, 0.2));
+  TEST_ASSERT_EQUAL_FLOAT(2, percentile(v, 0.21));
+  TEST_ASSERT_EQUAL_FLOAT(3, percentile(v, 0.5));
+  TEST_ASSERT_EQUAL_FLOAT(5, percentile(v, 0.9));
+  TEST_ASSERT_EQUAL_FLOAT(5, percentile(v, 1.0));
+
+  std::vector<float> one = { 7 };
+  TEST_ASSERT_EQUAL_FLOAT(7, percentile(one, 0.5));
+
+  std::vector<float> none;
+  TEST_ASSERT_TRUE(std::isnan(percentile(none, 0.5)));
+}
+
+static void test_conservation_per_policy() {
+  const SimConfig cfg = smallConfig();
+  const std::vector<Stats> perPolicy = runFleet(cfg);
+  TEST_ASSERT_EQUAL_UINT32(cfg.policies.size(), perPolicy.size());
+
+  for (const Stats &s : perPolicy) {
+    TEST_ASSERT_TRUE(s.messages > 0);
+    TEST_ASSERT_TRUE(s.delivered > 0);
+    TEST_ASSERT_TRUE(s.messages == s.delivered + s.pending);
+    TEST_ASSERT_TRUE(s.sessions >= s.delivered + s.wasted);
+    TEST_ASSERT_TRUE(s.blocked <= s.wasted);
+    TEST_ASSERT_TRUE(s.latency.size() == s.delivered);
+    TEST_ASSERT_TRUE(s.txJ > 0);
+    TEST_ASSERT_TRUE(s.idleJ >= 0);
+  }
+}
+
+static void test_no_sky_tries_cost_no_session() {
+  SimConfig cfg = smallConfig();
+  cfg.visibleMeanS = 10.0;
+  cfg.blockedMeanS = 1e6;
+  cfg.policies = { RetryPolicyKind::FIXED };
+  const Stats s = runFleet(cfg)[0];
+
+  // Sky is (almost) never visible: tries are skipped, not spent on air
+  TEST_ASSERT_TRUE(s.noSky > 0);
+  TEST_ASSERT_TRUE(s.sessions < s.noSky);
+}
+
+static void test_threads_do_not_change_results() {
+  SimConfig cfg = smallConfig();
+  const std::vector<Stats> one = runFleet(cfg);
+  cfg.threads = 4;
+  const std::vector<Stats> many = runFleet(cfg);
+
+  TEST_ASSERT_EQUAL_UINT32(one.size(), many.size());
+  for (size_t i = 0; i < one.size(); ++i) {
+    const Stats &a = one[i], &b = many[i];
+    TEST_ASSERT_TRUE(a.messages == b.messages && a.ignored == b.ignored);
+    TEST_ASSERT_TRUE(a.delivered == b.delivered && a.pending == b.pending);
+    TEST_ASSERT_TRUE(a.calls == b.calls && a.sessions == b.sessions && a.noSky == b.noSky);
+    TEST_ASSERT_TRUE(a.wasted == b.wasted && a.blocked == b.blocked);
+    TEST_ASSERT_TRUE(a.txJ == b.txJ && a.idleJ == b.idleJ);
+    TEST_ASSERT_TRUE(a.latency == b.latency);
+    TEST_ASSERT_TRUE(a.drillLatency == b.drillLatency);
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_gateway_serialises_same_ms_deliveries);
+  RUN_TEST(test_gateway_idle_adds_no_queueing);
+  RUN_TEST(test_percentile_nearest_rank);
+  RUN_TEST(test_conservation_per_policy);
+  RUN_TEST(test_no_sky_tries_cost_no_session);
+  RUN_TEST(test_threads_do_not_change_results);
+  return UNITY_END();
+}
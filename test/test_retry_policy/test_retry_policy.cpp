@@ -0,0 +1,130 @@
+#include <unity.h>
+#include "../../include/retry_policy.h"
+
+// Run with: pio test -e native
+
+void setUp() {}
+void tearDown() {}
+
+static void test_fixed_returns_retry_delay() {
+  uint32_t rng = 1;
+  for (uint32_t attempt = 0; attempt < 50; ++attempt) {
+    TEST_ASSERT_EQUAL_UINT32(RETRY_DELAY_MS, retryDelayMs(RETRY_POLICY_DEFAULT, attempt, 0, rng));
+  }
+  TEST_ASSERT_EQUAL_UINT32(1, rng); // FIXED never touches the jitter state
+}
+
+static void test_backoff_ceiling_doubles_then_clamps() {
+  const RetryPolicy p = { RetryPolicyKind::EXPONENTIAL, 10000, 300000 };
+  TEST_ASSERT_EQUAL_UINT32(10000,  retryBackoffCeilingMs(p, 0));
+  TEST_ASSERT_EQUAL_UINT32(20000,  retryBackoffCeilingMs(p, 1));
+  TEST_ASSERT_EQUAL_UINT32(160000, retryBackoffCeilingMs(p, 4));
+  TEST_ASSERT_EQUAL_UINT32(300000, retryBackoffCeilingMs(p, 5));
+  TEST_ASSERT_EQUAL_UINT32(300000, retryBackoffCeilingMs(p, 0xFFFFFFFFUL));
+}
+
+static void test_backoff_ceiling_does_not_overflow() {
+  const RetryPolicy p = { RetryPolicyKind::EXPONENTIAL, 0x80000001UL, 0xFFFFFFFFUL };
+  TEST_ASSERT_EQUAL_UINT32(0x80000001UL, retryBackoffCeilingMs(p, 0));
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFUL, retryBackoffCeilingMs(p, 1));
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFUL, retryBackoffCeilingMs(p, 40));
+
+  const RetryPolicy big = { RetryPolicyKind::EXPONENTIAL, 3000000000UL, 4000000000UL };
+  TEST_ASSERT_EQUAL_UINT32(4000000000UL, retryBackoffCeilingMs(big, 1));
+
+  const RetryPolicy baseAboveCap = { RetryPolicyKind::EXPONENTIAL, 500, 100 };
+  TEST_ASSERT_EQUAL_UINT32(100, retryBackoffCeilingMs(baseAboveCap, 0));
+}
+
+static void test_exponential_matches_ceiling() {
+  const RetryPolicy p = { RetryPolicyKind::EXPONENTIAL, 10000, 300000 };
+  uint32_t rng = 7;
+  for (uint32_t attempt = 0; attempt < 40; ++attempt) {
+    TEST_ASSERT_EQUAL_UINT32(retryBackoffCeilingMs(p, attempt), retryDelayMs(p, attempt, 0, rng));
+  }
+}
+
+static void test_full_jitter_within_zero_and_ceiling() {
+  const RetryPolicy p = { RetryPolicyKind::FULL_JITTER, 10000, 300000 };
+  uint32_t rng = 12345;
+  for (uint32_t attempt = 0; attempt < 40; ++attempt) {
+    const uint32_t ceiling = retryBackoffCeilingMs(p, attempt);
+    for (int i = 0; i < 200; ++i) {
+      TEST_ASSERT_LESS_OR_EQUAL_UINT32(ceiling, retryDelayMs(p, attempt, 0, rng));
+    }
+  }
+}
+
+static void test_decorrelated_within_base_and_three_prev() {
+  const RetryPolicy p = { RetryPolicyKind::DECORRELATED_JITTER, 10000, 300000 };
+  uint32_t rng = 99;
+  uint32_t prev = 0;
+  for (uint32_t attempt = 0; attempt < 2000; ++attempt) {
+    const uint32_t effPrev = (prev < p.baseMs) ? p.baseMs : prev;
+    const uint64_t hi = static_cast<uint64_t>(effPrev) * 3;
+    const uint32_t bound = (hi > p.capMs) ? p.capMs : static_cast<uint32_t>(hi);
+    const uint32_t d = retryDelayMs(p, attempt, prev, rng);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(p.baseMs, d);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(bound, d);
+    prev = d;
+  }
+}
+
+static void test_decorrelated_huge_prev_clamps_to_cap() {
+  const RetryPolicy p = { RetryPolicyKind::DECORRELATED_JITTER, 10000, 300000 };
+  uint32_t rng = 5;
+  for (int i = 0; i < 200; ++i) {
+    const uint32_t d = retryDelayMs(p, 0, 0xFFFFFFFFUL, rng);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(p.baseMs, d);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(p.capMs, d);
+  }
+}
+
+static void test_rand_range_degenerate_returns_lo() {
+  uint32_t rng = 42;
+  TEST_ASSERT_EQUAL_UINT32(500, retryRandRange(rng, 500, 500));
+  TEST_ASSERT_EQUAL_UINT32(500, retryRandRange(rng, 500, 100));
+  TEST_ASSERT_EQUAL_UINT32(42, rng); // no draw consumed
+}
+
+static void test_rand_range_inclusive_bounds() {
+  uint32_t rng = 3;
+  bool sawLo = false, sawHi = false;
+  for (int i = 0; i < 1000; ++i) {
+    const uint32_t v = retryRandRange(rng, 10, 13);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(10, v);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(13, v);
+    sawLo |= (v == 10); sawHi |= (v == 13);
+  }
+  TEST_ASSERT_TRUE(sawLo);
+  TEST_ASSERT_TRUE(sawHi);
+}
+
+static void test_rand_zero_state_recovers() {
+  uint32_t rng = 0;
+  TEST_ASSERT_NOT_EQUAL(0, retryRandNext(rng));
+  TEST_ASSERT_NOT_EQUAL(0, rng);
+}
+
+static int runAll() {
+  UNITY_BEGIN();
+  RUN_TEST(test_fixed_returns_retry_delay);
+  RUN_TEST(test_backoff_ceiling_doubles_then_clamps);
+  RUN_TEST(test_backoff_ceiling_does_not_overflow);
+  RUN_TEST(test_exponential_matches_ceiling);
+  RUN_TEST(test_full_jitter_within_zero_and_ceiling);
+  RUN_TEST(test_decorrelated_within_base_and_three_prev);
+  RUN_TEST(test_decorrelated_huge_prev_clamps_to_cap);
+  RUN_TEST(test_rand_range_degenerate_returns_lo);
+  RUN_TEST(test_rand_range_inclusive_bounds);
+  RUN_TEST(test_rand_zero_state_recovers);
+  return UNITY_END();
+}
+
+#ifdef ARDUINO
+#include <Arduino.h>
+void setup() { delay(2000); runAll(); }
+void loop() {}
+#else
+int main() { return runAll(); }
+#endif
@@ -0,0 +1,262 @@
+//
+// Fleet-scale discrete-event simulator for the send / retry logic in src/main.cpp.
+//
+// Every virtual unit runs the same state machine as the firmware:
+//   button press → sendReceiveSBDBinary() → IridiumSBD retries SBDIX every
+//   sbdix-interval until the send/receive timeout from setup() expires →
+//   loop() waits retryDelayMs() (include/retry_policy.h) → call again.
+// Units share a model of satellite visibility and SBD channel capacity per
+// cell. Cells are independent, so each (policy, cell) pair is simulated on
+// its own worker thread. Delivered MOs then pass through one fleet-wide FIFO
+// gateway with a fixed throughput, so a drill burst backs up behind itself.
+// The firmware never waits on the gateway, so this runs as a post-pass in
+// SBDIX completion order.
+//
+// Build (host):
+//   c++ -O2 -std=c++17 -pthread tools/fleet_sim/fleet_sim.cpp -o fleet_sim
+//
+
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "fleet_sim.h"
+
+// =========================
+// Reporting
+// =========================
+static void printReport(const SimConfig &cfg, std::vector<Stats> &perPolicy, const double wallS) {
+  std::printf("Fleet: %d units, %d cells x %d channels, %.1f h, %.1f msgs/unit/day",
+              cfg.devices, cfg.cells, cfg.channelsPerCell, cfg.hours, cfg.msgsPerDevicePerDay);
+  if (cfg.drillAtH >= 0) std::printf(", drill at %.1f h (%.0f%%)", cfg.drillAtH, cfg.drillFraction * 100.0);
+  std::printf(", send timeout %.0f s, seed %llu\n\n", cfg.sendTimeoutS, static_cast<unsigned long long>(cfg.seed));
+
+  std::printf("%-13s %7s %7s %5s %7s %7s %7s %7s %8s %8s %8s %9s %8s %8s %8s %7s %8s %8s\n",
+              "policy", "msgs", "deliv", "pend", "ignored", "p50 s", "p90 s", "p99 s", "max s",
+              "drl p50", "drl p99", "sessions", "wasted", "blocked", "no-sky", "wst/msg", "TX J/msg", "J/msg");
+
+  for (size_t i = 0; i < cfg.policies.size(); ++i) {
+    Stats &s = perPolicy[i];
+    const double deliv = s.delivered ? static_cast<double>(s.delivered) : NAN;
+    std::printf("%-13s %7llu %7llu %5llu %7llu %7.1f %7.1f %7.1f %8.1f %8.1f %8.1f %9llu %8llu %8llu %8llu %7.2f %8.2f %8.2f\n",
+                retryPolicyToStr(cfg.policies[i]),
+                static_cast<unsigned long long>(s.messages), static_cast<unsigned long long>(s.delivered),
+                static_cast<unsigned long long>(s.pending), static_cast<unsigned long long>(s.ignored),
+                percentile(s.latency, 0.50), percentile(s.latency, 0.90), percentile(s.latency, 0.99),
+                percentile(s.latency, 1.0),
+                percentile(s.drillLatency, 0.50), percentile(s.drillLatency, 0.99),
+                static_cast<unsigned long long>(s.sessions), static_cast<unsigned long long>(s.wasted),
+                static_cast<unsigned long long>(s.blocked), static_cast<unsigned long long>(s.noSky),
+                static_cast<double>(s.wasted) / deliv, s.txJ / deliv, (s.txJ + s.idleJ) / deliv);
+  }
+  std::printf("\nno-sky   = tries the MSSTM workaround skipped (no session, no TX)\n"
+              "wst/msg  = failed SBDIX sessions per delivered message\n"
+              "TX J/msg = SBDIX airtime energy per delivered message\n"
+              "J/msg    = TX plus idle modem energy from press to delivery (or end of run) per delivered message\n");
+  std::printf("Simulated in %.2f s on %d thread(s).\n", wallS, cfg.threads);
+}
+
+// =========================
+// CLI
+// =========================
+static void usage(const char *argv0) {
+  const SimConfig d;
+  std::printf(
+    "Usage: %s [options]\n"
+    "  --devices N          units in the fleet (%d)\n"
+    "  --hours H            simulated time (%.0f)\n"
+    "  --cells N            cells sharing satellite visibility / capacity (%d)\n"
+    "  --channels N         concurrent SBDIX sessions per cell (%d)\n"
+    "  --rate R             background presses per unit per day (%.1f)\n"
+    "  --drill-at H         group drill start in hours, <0 disables (%.1f)\n"
+    "  --drill-fraction F   share of units pressing in the drill (%.2f)\n"
+    "  --drill-spread S     drill presses spread over S seconds (%.1f)\n"
+    "  --visible-mean S     mean visible period per cell (%.0f)\n"
+    "  --blocked-mean S     mean blocked period per cell (%.0f)\n"
+    "  --quality-min P      min per-unit SBDIX success probability (%.2f)\n"
+    "  --quality-max P      max per-unit SBDIX success probability (%.2f)\n"
+    "  --sbdix-interval S   library wait between SBDIX tries (%.0f)\n"
+    "  --send-timeout S     adjustSendReceiveTimeout() value (%.0f)\n"
+    "  --gateway-min S      gateway transit latency, excluding queueing (%.1f)\n"
+    "  --gateway-rate R     fleet-wide gateway throughput, messages/s (%.1f)\n"
+    "  --tx-watts W         radio power during SBDIX (%.3f)\n"
+    "  --idle-watts W       modem power while awake between sessions (%.3f)\n"
+    "  --base-ms MS         retry policy base delay (%u)\n"
+    "  --cap-ms MS          retry policy delay cap (%u)\n"
+    "  --policies LIST      comma list of fixed,exponential,full-jitter,decorrelated (all)\n"
+    "  --seed N             RNG seed (%llu)\n"
+    "  --threads N          worker threads, 0 = all cores (%d)\n",
+    argv0, d.devices, d.hours, d.cells, d.channelsPerCell, d.msgsPerDevicePerDay, d.drillAtH,
+    d.drillFraction, d.drillSpreadS, d.visibleMeanS, d.blockedMeanS, d.qualityMin, d.qualityMax,
+    d.sbdixIntervalS, d.sendTimeoutS, d.gatewayMinS, d.gatewayRate, d.txWatts, d.idleWatts,
+    static_cast<unsigned>(d.baseMs), static_cast<unsigned>(d.capMs),
+    static_cast<unsigned long long>(d.seed), d.threads);
+}
+
+static bool parsePolicies(const char *list, std::vector<RetryPolicyKind> &out) {
+  static constexpr RetryPolicyKind ALL[] = {
+    RetryPolicyKind::FIXED, RetryPolicyKind::EXPONENTIAL,
+    RetryPolicyKind::FULL_JITTER, RetryPolicyKind::DECORRELATED_JITTER
+  };
+  out.clear();
+  std::string s(list);
+  size_t pos = 0;
+  while (pos <= s.size()) {
+    const size_t comma = std::min(s.find(',', pos), s.size());
+    const std::string name = s.substr(pos, comma - pos);
+    bool found = false;
+    for (const RetryPolicyKind k : ALL) {
+      if (name == retryPolicyToStr(k)) { out.push_back(k); found = true; break; }
+    }
+    if (!found) { std::fprintf(stderr, "Unknown policy '%s'\n", name.c_str()); return false; }
+    pos = comma + 1;
+  }
+  return !out.empty();
+}
+
+// Strict number parsing: the whole argument must be consumed
+static bool parseDouble(const char *val, double &out) {
+  char *end = nullptr;
+  errno = 0;
+  const double v = std::strtod(val, &end);
+  if (end == val || *end != '\0' || errno == ERANGE || !std::isfinite(v)) return false;
+  out = v;
+  return true;
+}
+
+static bool parseInt(const char *val, int &out) {
+  char *end = nullptr;
+  errno = 0;
+  const long v = std::strtol(val, &end, 10);
+  if (end == val || *end != '\0' || errno == ERANGE || v < INT_MIN || v > INT_MAX) return false;
+  out = static_cast<int>(v);
+  return true;
+}
+
+static bool parseU64(const char *val, const uint64_t max, uint64_t &out) {
+  char *end = nullptr;
+  errno = 0;
+  if (val[0] == '-') return false;
+  const unsigned long long v = std::strtoull(val, &end, 10);
+  if (end == val || *end != '\0' || errno == ERANGE || v > max) return false;
+  out = v;
+  return true;
+}
+
+// Bounds keep every seconds value well inside llround()/int64 ms and cap the
+// sky toggle and press vectors, which grow with horizon / period.
+static constexpr double MAX_HOURS         = 24.0 * 366;
+static constexpr double MAX_SECONDS       = MAX_HOURS * 3600.0;
+static constexpr int    MAX_DEVICES       = 10000000;
+static constexpr double MIN_SKY_PERIOD_S  = 10.0;   // mean visible / blocked period
+static constexpr double MIN_PRESS_GAP_S   = 1.0;    // mean gap between background presses
+static constexpr double MAX_TOTAL_PRESSES = 1e8;    // expected background presses, fleet-wide
+
+static bool parseArgs(const int argc, char **argv, SimConfig &cfg) {
+  struct DoubleOpt { const char *flag; double *dst; };
+  const DoubleOpt doubles[] = {
+    { "--hours", &cfg.hours }, { "--rate", &cfg.msgsPerDevicePerDay },
+    { "--drill-at", &cfg.drillAtH }, { "--drill-fraction", &cfg.drillFraction },
+    { "--drill-spread", &cfg.drillSpreadS }, { "--visible-mean", &cfg.visibleMeanS },
+    { "--blocked-mean", &cfg.blockedMeanS }, { "--quality-min", &cfg.qualityMin },
+    { "--quality-max", &cfg.qualityMax }, { "--sbdix-interval", &cfg.sbdixIntervalS },
+    { "--send-timeout", &cfg.sendTimeoutS }, { "--gateway-min", &cfg.gatewayMinS },
+    { "--gateway-rate", &cfg.gatewayRate }, { "--tx-watts", &cfg.txWatts },
+    { "--idle-watts", &cfg.idleWatts },
+  };
+
+  for (int i = 1; i < argc; ++i) {
+    const char *flag = argv[i];
+    if (strcmp(flag, "-h") == 0 || strcmp(flag, "--help") == 0) { usage(argv[0]); std::exit(0); }
+    if (i + 1 >= argc) { std::fprintf(stderr, "Missing value for %s\n", flag); return false; }
+    const char *val = argv[++i];
+
+    bool matched = false, ok = true;
+    for (const DoubleOpt &o : doubles) {
+      if (strcmp(flag, o.flag) == 0) { matched = true; ok = parseDouble(val, *o.dst); break; }
+    }
+
+    uint64_t u = 0;
+    if (matched) { /* handled above */ }
+    else if (strcmp(flag, "--devices") == 0)  ok = parseInt(val, cfg.devices);
+    else if (strcmp(flag, "--cells") == 0)    ok = parseInt(val, cfg.cells);
+    else if (strcmp(flag, "--channels") == 0) ok = parseInt(val, cfg.channelsPerCell);
+    else if (strcmp(flag, "--threads") == 0)  ok = parseInt(val, cfg.threads);
+    else if (strcmp(flag, "--base-ms") == 0)  { ok = parseU64(val, UINT32_MAX, u); cfg.baseMs = static_cast<uint32_t>(u); }
+    else if (strcmp(flag, "--cap-ms") == 0)   { ok = parseU64(val, UINT32_MAX, u); cfg.capMs = static_cast<uint32_t>(u); }
+    else if (strcmp(flag, "--seed") == 0)     ok = parseU64(val, UINT64_MAX, cfg.seed);
+    else if (strcmp(flag, "--policies") == 0) { if (!parsePolicies(val, cfg.policies)) return false; }
+    else { std::fprintf(stderr, "Unknown option %s\n", flag); return false; }
+
+    if (!ok) { std::fprintf(stderr, "Invalid value '%s' for %s\n", val, flag); return false; }
+  }
+
+  if (cfg.devices <= 0 || cfg.cells <= 0 || cfg.channelsPerCell <= 0 || cfg.hours <= 0) {
+    std::fprintf(stderr, "devices, cells, channels and hours must be positive\n");
+    return false;
+  }
+  if (cfg.hours > MAX_HOURS || cfg.drillAtH > MAX_HOURS) {
+    std::fprintf(stderr, "hours and drill-at must be at most %.0f\n", MAX_HOURS);
+    return false;
+  }
+  if (cfg.devices > MAX_DEVICES) {
+    std::fprintf(stderr, "devices must be at most %d\n", MAX_DEVICES);
+    return false;
+  }
+  if (cfg.drillSpreadS > MAX_SECONDS || cfg.visibleMeanS > MAX_SECONDS || cfg.blockedMeanS > MAX_SECONDS ||
+      cfg.sbdixIntervalS > MAX_SECONDS || cfg.sendTimeoutS > MAX_SECONDS || cfg.gatewayMinS > MAX_SECONDS) {
+    std::fprintf(stderr, "second-valued options must be at most %.0f\n", MAX_SECONDS);
+    return false;
+  }
+  if (cfg.visibleMeanS < MIN_SKY_PERIOD_S || cfg.blockedMeanS < MIN_SKY_PERIOD_S) {
+    std::fprintf(stderr, "visible/blocked means must be at least %.0f s\n", MIN_SKY_PERIOD_S);
+    return false;
+  }
+  if (cfg.msgsPerDevicePerDay > 86400.0 / MIN_PRESS_GAP_S ||
+      cfg.msgsPerDevicePerDay * cfg.devices * cfg.hours / 24.0 > MAX_TOTAL_PRESSES) {
+    std::fprintf(stderr, "rate must be at most %.0f per day and %.0e presses fleet-wide\n",
+                 86400.0 / MIN_PRESS_GAP_S, MAX_TOTAL_PRESSES);
+    return false;
+  }
+  if (cfg.threads < 0) {
+    std::fprintf(stderr, "threads must be 0 (all cores) or positive\n");
+    return false;
+  }
+  if (cfg.drillFraction < 0 || cfg.drillFraction > 1 ||
+      cfg.qualityMin < 0 || cfg.qualityMax > 1 || cfg.qualityMin > cfg.qualityMax) {
+    std::fprintf(stderr, "drill fraction and quality must lie in [0,1] with quality-min <= quality-max\n");
+    return false;
+  }
+  if (cfg.msgsPerDevicePerDay < 0 || cfg.drillSpreadS < 0 || cfg.gatewayMinS < 0 ||
+      cfg.txWatts < 0 || cfg.idleWatts < 0 || cfg.gatewayRate <= 0) {
+    std::fprintf(stderr, "rate, drill spread, gateway min and tx/idle watts must be >= 0; gateway rate > 0\n");
+    return false;
+  }
+  if (cfg.sbdixIntervalS < 0 || cfg.sendTimeoutS <= 0) {
+    std::fprintf(stderr, "sbdix interval must be >= 0 and send timeout positive\n");
+    return false;
+  }
+  if (cfg.capMs < cfg.baseMs) cfg.capMs = cfg.baseMs;
+  if (cfg.cells > cfg.devices) cfg.cells = cfg.devices;
+  return true;
+}
+
+int main(int argc, char **argv) {
+  SimConfig cfg;
+  if (!parseArgs(argc, argv, cfg)) { usage(argv[0]); return 1; }
+  if (cfg.threads <= 0) cfg.threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+  const size_t nTasks = cfg.policies.size() * static_cast<size_t>(cfg.cells);
+  cfg.threads = static_cast<int>(std::min(static_cast<size_t>(cfg.threads), nTasks));
+
+  const auto t0 = std::chrono::steady_clock::now();
+  std::vector<Stats> perPolicy = runFleet(cfg);
+  const double wallS = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+  printReport(cfg, perPolicy, wallS);
+  return 0;
+}
@@ -0,0 +1,377 @@
+#ifndef IRIDIUM_SATELLITE_COMM_FLEET_SIM_H
+#define IRIDIUM_SATELLITE_COMM_FLEET_SIM_H
+
+// Simulation core for tools/fleet_sim: scenario, per-cell discrete-event model,
+// fleet-wide gateway and percentiles. Header-only so the native unit tests
+// (test/test_fleet_sim) can drive it directly; fleet_sim.cpp adds the CLI.
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "../../include/retry_policy.h"
+
+// =========================
+// Scenario
+// =========================
+struct SimConfig {
+  int    devices            = 5000;
+  double hours              = 24.0;
+  int    cells              = 50;     // devices are spread round-robin across cells
+  int    channelsPerCell    = 8;      // concurrent SBDIX sessions a cell can carry
+
+  double msgsPerDevicePerDay = 4.0;   // background presses (Poisson)
+  double drillAtH           = 8.0;    // group SOS drill start (hours into the run, <0 = none)
+  double drillFraction      = 1.0;    // share of units that press during the drill
+  double drillSpreadS       = 5.0;    // presses land uniformly in [drillAt, drillAt + spread]
+
+  double visibleMeanS       = 600.0;  // per-cell sky: mean visible period
+  double blockedMeanS       = 90.0;   // per-cell sky: mean gap between passes
+  double qualityMin         = 0.50;   // per-unit P(SBDIX ok | visible, channel free)
+  double qualityMax         = 0.95;
+
+  double sbdixOkMinS        = 6.0,  sbdixOkMaxS   = 15.0; // successful session length
+  double sbdixFailMinS      = 5.0,  sbdixFailMaxS = 30.0; // failed session length
+  double blockedMinS        = 2.0,  blockedMaxS   = 5.0;  // rejected, no channel free
+
+  double sbdixIntervalS     = 10.0;   // IridiumSBD wait between SBDIX / MSSTM tries (default power profile)
+  double sendTimeoutS       = 300.0;  // modem.adjustSendReceiveTimeout() in setup()
+
+  double gatewayMinS        = 2.0;    // gateway → endpoint transit, excluding queueing
+  double gatewayRate        = 25.0;   // messages per second the gateway forwards
+
+  double txWatts            = 0.725;  // RockBLOCK 9603 session draw, ~145 mA @ 5 V
+  double idleWatts          = 0.170;  // modem awake between sessions, ~34 mA @ 5 V (no sleep pin)
+
+  uint32_t baseMs           = RETRY_DELAY_MS;
+  uint32_t capMs            = RETRY_CAP_MS;
+
+  uint64_t seed             = 1;
+  int      threads          = 0;      // 0 = hardware_concurrency()
+  std::vector<RetryPolicyKind> policies = {
+    RetryPolicyKind::FIXED, RetryPolicyKind::EXPONENTIAL,
+    RetryPolicyKind::FULL_JITTER, RetryPolicyKind::DECORRELATED_JITTER
+  };
+};
+
+// =========================
+// RNG (splitmix64: deterministic across platforms / standard libraries)
+// =========================
+struct Rng {
+  uint64_t s;
+
+  explicit Rng(const uint64_t seed) : s(seed) {}
+
+  uint64_t next() {
+    uint64_t z = (s += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+  double uniform() { return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0); }
+  double uniform(const double lo, const double hi) { return lo + (hi - lo) * uniform(); }
+  double exponential(const double mean) { return -mean * std::log1p(-uniform()); }
+};
+
+static inline uint64_t mixSeed(const uint64_t a, const uint64_t b, const uint64_t c) {
+  Rng r(a ^ (b * 0xD1B54A32D192ED03ULL) ^ (c * 0x8CB92BA72F3D8DD7ULL));
+  return r.next();
+}
+
+// Seed streams: environment draws are shared by every policy (common random numbers)
+enum : uint64_t { STREAM_SKY = 1, STREAM_PRESS = 2, STREAM_UNIT = 3 };
+
+static inline int64_t secToMs(const double s) { return static_cast<int64_t>(std::llround(s * 1000.0)); }
+
+// =========================
+// Model
+// =========================
+struct Press { int64_t t; bool drill; };
+
+struct Unit {
+  double   quality = 0;
+  std::vector<Press> presses;
+  size_t   nextPress = 0;
+
+  // In-flight message (firmware blocks in loop() until it is delivered)
+  bool     busy = false;
+  bool     drillMsg = false;
+  int64_t  msgStart = 0;
+  int64_t  airMs = 0;      // SBDIX airtime spent on this message so far
+  int64_t  callStart = 0;
+  uint32_t attempt = 0;
+  uint32_t retryDelay = 0;
+  uint32_t retryRng = 0;
+
+  // Outcome of the SBDIX currently on air
+  bool     sessionOk = false;
+  bool     sessionHeld = false;
+  int64_t  sessionMs = 0;
+
+  Rng      rng{0};
+};
+
+enum EventType : uint8_t { EV_PRESS, EV_CALL, EV_SBDIX_START, EV_SBDIX_END };
+
+struct Event {
+  int64_t  t;
+  uint64_t seq;
+  uint32_t unit;
+  EventType type;
+  bool operator>(const Event &o) const { return t != o.t ? t > o.t : seq > o.seq; }
+};
+
+struct Delivery {
+  int64_t done;    // SBDIX success (MO reached the gateway)
+  int64_t start;   // button press
+  bool    drill;
+};
+
+struct Stats {
+  uint64_t messages = 0;   // presses the firmware acted on
+  uint64_t ignored  = 0;   // presses while the unit was still retrying
+  uint64_t delivered = 0;
+  uint64_t pending  = 0;   // still retrying when the run ended
+  uint64_t calls    = 0;   // sendReceiveSBDBinary() calls
+  uint64_t sessions = 0;   // SBDIX attempts
+  uint64_t noSky    = 0;   // tries skipped by the MSSTM workaround (no satellite in view)
+  uint64_t wasted   = 0;   // SBDIX attempts that did not deliver
+  uint64_t blocked  = 0;   // ... of which rejected for lack of a channel
+  double   txJ      = 0;   // SBDIX airtime at txWatts
+  double   idleJ    = 0;   // rest of each unit's busy time at idleWatts
+  std::vector<Delivery> deliveries;
+  std::vector<float> latency, drillLatency;  // filled by runGateway()
+
+  void merge(const Stats &o) {
+    messages += o.messages; ignored += o.ignored; delivered += o.delivered; pending += o.pending;
+    calls += o.calls; sessions += o.sessions; noSky += o.noSky; wasted += o.wasted; blocked += o.blocked;
+    txJ += o.txJ; idleJ += o.idleJ;
+    deliveries.insert(deliveries.end(), o.deliveries.begin(), o.deliveries.end());
+  }
+};
+
+// Alternating visible / blocked periods for one cell
+struct Sky {
+  std::vector<int64_t> toggles;  // times at which visibility flips
+  bool   visibleAtZero = true;
+  size_t cursor = 0;             // queries arrive in time order
+
+  bool visibleAt(const int64_t t) {
+    while (cursor < toggles.size() && toggles[cursor] <= t) ++cursor;
+    return visibleAtZero == (cursor % 2 == 0);
+  }
+};
+
+static inline Sky buildSky(const SimConfig &cfg, const int cell, const int64_t horizon) {
+  Rng r(mixSeed(cfg.seed, STREAM_SKY, static_cast<uint64_t>(cell)));
+  Sky sky;
+  sky.visibleAtZero = r.uniform() < cfg.visibleMeanS / (cfg.visibleMeanS + cfg.blockedMeanS);
+  bool visible = sky.visibleAtZero;
+  for (int64_t t = 0; t < horizon;) {
+    t += std::max<int64_t>(1, secToMs(r.exponential(visible ? cfg.visibleMeanS : cfg.blockedMeanS)));
+    sky.toggles.push_back(t);
+    visible = !visible;
+  }
+  return sky;
+}
+
+static inline void buildUnit(const SimConfig &cfg, const uint32_t id, const int64_t horizon, Unit &u) {
+  Rng r(mixSeed(cfg.seed, STREAM_PRESS, id));
+  u.quality = r.uniform(cfg.qualityMin, cfg.qualityMax);
+
+  if (cfg.msgsPerDevicePerDay > 0) {
+    const double meanGapS = 86400.0 / cfg.msgsPerDevicePerDay;
+    for (int64_t t = secToMs(r.exponential(meanGapS)); t < horizon;
+         t += std::max<int64_t>(1, secToMs(r.exponential(meanGapS)))) {
+      u.presses.push_back({ t, false });
+    }
+  }
+  if (cfg.drillAtH >= 0 && r.uniform() < cfg.drillFraction) {
+    const int64_t t = secToMs(cfg.drillAtH * 3600.0 + r.uniform(0, cfg.drillSpreadS));
+    if (t < horizon) u.presses.push_back({ t, true });
+  }
+  std::sort(u.presses.begin(), u.presses.end(), [](const Press &a, const Press &b) { return a.t < b.t; });
+
+  const uint64_t unitSeed = mixSeed(cfg.seed, STREAM_UNIT, id);
+  u.rng = Rng(unitSeed);
+  u.retryRng = static_cast<uint32_t>(unitSeed) | 1UL;  // firmware seeds from micros()
+}
+
+// =========================
+// One cell under one policy
+// =========================
+static inline Stats simulateCell(const SimConfig &cfg, const RetryPolicy &policy, const int cell) {
+  const int64_t horizon = secToMs(cfg.hours * 3600.0);
+  const int64_t intervalMs = secToMs(cfg.sbdixIntervalS);
+  const int64_t timeoutMs = secToMs(cfg.sendTimeoutS);
+
+  Sky sky = buildSky(cfg, cell, horizon);
+
+  std::vector<Unit> units;
+  for (int id = cell; id < cfg.devices; id += cfg.cells) {
+    units.emplace_back();
+    buildUnit(cfg, static_cast<uint32_t>(id), horizon, units.back());
+  }
+
+  std::priority_queue<Event, std::vector<Event>, std::greater<>> queue;
+  uint64_t seq = 0;
+  auto schedule = [&](const int64_t t, const uint32_t unit, const EventType type) {
+    if (t <= horizon) queue.push({ t, seq++, unit, type });
+  };
+  for (uint32_t i = 0; i < units.size(); ++i) {
+    if (!units[i].presses.empty()) schedule(units[i].presses[0].t, i, EV_PRESS);
+  }
+
+  Stats st;
+  int activeChannels = 0;
+
+  // IridiumSBD: wait sbdixInterval, then retry SBDIX while inside the send/receive timeout
+  auto libraryRetry = [&](const int64_t t, const uint32_t unit) {
+    Unit &u = units[unit];
+    const int64_t next = t + intervalMs;
+    if (next - u.callStart < timeoutMs) {
+      schedule(next, unit, EV_SBDIX_START);
+    } else {
+      // Library gave up → loop() backs off per policy and calls again
+      u.retryDelay = retryDelayMs(policy, u.attempt++, u.retryDelay, u.retryRng);
+      schedule(next + u.retryDelay, unit, EV_CALL);
+    }
+  };
+
+  while (!queue.empty()) {
+    const Event ev = queue.top();
+    queue.pop();
+    Unit &u = units[ev.unit];
+
+    switch (ev.type) {
+      case EV_PRESS: {
+        const Press p = u.presses[u.nextPress++];
+        if (u.nextPress < u.presses.size()) schedule(u.presses[u.nextPress].t, ev.unit, EV_PRESS);
+        if (u.busy) { ++st.ignored; break; }
+        ++st.messages;
+        u.busy = true; u.drillMsg = p.drill; u.msgStart = ev.t; u.airMs = 0;
+        u.attempt = 0; u.retryDelay = 0;
+        schedule(ev.t, ev.unit, EV_CALL);
+        break;
+      }
+
+      case EV_CALL:
+        ++st.calls;
+        u.callStart = ev.t;
+        schedule(ev.t, ev.unit, EV_SBDIX_START);
+        break;
+
+      case EV_SBDIX_START:
+        if (!sky.visibleAt(ev.t)) {
+          // No satellite in view: the MSSTM workaround (left at the library default in
+          // setup()) sees no network time, skips SBDIX and just waits sbdixInterval
+          ++st.noSky;
+          libraryRetry(ev.t, ev.unit);
+          break;
+        }
+        ++st.sessions;
+        if (activeChannels >= cfg.channelsPerCell) {
+          ++st.blocked;
+          u.sessionOk = false; u.sessionHeld = false;
+          u.sessionMs = secToMs(u.rng.uniform(cfg.blockedMinS, cfg.blockedMaxS));
+        } else {
+          ++activeChannels;
+          u.sessionHeld = true;
+          u.sessionOk = u.rng.uniform() < u.quality;
+          u.sessionMs = u.sessionOk ? secToMs(u.rng.uniform(cfg.sbdixOkMinS, cfg.sbdixOkMaxS))
+                                    : secToMs(u.rng.uniform(cfg.sbdixFailMinS, cfg.sbdixFailMaxS));
+        }
+        schedule(ev.t + u.sessionMs, ev.unit, EV_SBDIX_END);
+        break;
+
+      case EV_SBDIX_END: {
+        if (u.sessionHeld) --activeChannels;
+        st.txJ += cfg.txWatts * static_cast<double>(u.sessionMs) / 1000.0;
+        u.airMs += u.sessionMs;
+
+        if (u.sessionOk) {
+          ++st.delivered;
+          st.idleJ += cfg.idleWatts * static_cast<double>(ev.t - u.msgStart - u.airMs) / 1000.0;
+          st.deliveries.push_back({ ev.t, u.msgStart, u.drillMsg });
+          u.busy = false;
+          break;
+        }
+
+        ++st.wasted;
+        libraryRetry(ev.t, ev.unit);
+        break;
+      }
+    }
+  }
+
+  for (const Unit &u : units) {
+    if (!u.busy) continue;
+    ++st.pending;
+    st.idleJ += cfg.idleWatts * static_cast<double>(horizon - u.msgStart - u.airMs) / 1000.0;
+  }
+  return st;
+}
+
+// =========================
+// Fleet-wide gateway (single FIFO server)
+// =========================
+static inline void runGateway(const SimConfig &cfg, Stats &st) {
+  std::sort(st.deliveries.begin(), st.deliveries.end(), [](const Delivery &a, const Delivery &b) {
+    return a.done != b.done ? a.done < b.done : a.start < b.start;
+  });
+  const double serviceS = 1.0 / cfg.gatewayRate;
+  double freeAt = 0;  // seconds
+  st.latency.clear(); st.drillLatency.clear();
+  st.latency.reserve(st.deliveries.size());
+  for (const Delivery &d : st.deliveries) {
+    const double arrive = static_cast<double>(d.done) / 1000.0;
+    freeAt = std::max(freeAt, arrive) + serviceS;
+    const auto lat = static_cast<float>(freeAt + cfg.gatewayMinS - static_cast<double>(d.start) / 1000.0);
+    st.latency.push_back(lat);
+    if (d.drill) st.drillLatency.push_back(lat);
+  }
+}
+
+// =========================
+// Whole fleet: every (policy, cell) pair on cfg.threads workers, then the gateway
+// =========================
+static inline std::vector<Stats> runFleet(const SimConfig &cfg) {
+  const size_t nPolicies = cfg.policies.size();
+  const size_t nTasks = nPolicies * static_cast<size_t>(cfg.cells);
+  std::vector<Stats> results(nTasks);
+  std::atomic<size_t> nextTask{0};
+
+  auto worker = [&]() {
+    for (size_t task; (task = nextTask.fetch_add(1)) < nTasks;) {
+      const RetryPolicy policy = { cfg.policies[task / cfg.cells], cfg.baseMs, cfg.capMs };
+      results[task] = simulateCell(cfg, policy, static_cast<int>(task % cfg.cells));
+    }
+  };
+  std::vector<std::thread> pool;
+  for (int i = 1; i < cfg.threads; ++i) pool.emplace_back(worker);
+  worker();
+  for (std::thread &t : pool) t.join();
+
+  // Merge in task order so the result does not depend on which worker ran what
+  std::vector<Stats> perPolicy(nPolicies);
+  for (size_t task = 0; task < nTasks; ++task) perPolicy[task / cfg.cells].merge(results[task]);
+  for (Stats &s : perPolicy) runGateway(cfg, s);
+  return perPolicy;
+}
+
+// =========================
+// Percentiles (nearest rank; reorders v)
+// =========================
+static inline double percentile(std::vector<float> &v, const double p) {
+  if (v.empty()) return NAN;
+  const size_t idx = std::min(v.size() - 1, static_cast<size_t>(std::ceil(p * static_cast<double>(v.size()))) - (p > 0 ? 1 : 0));
+  std::nth_element(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(idx), v.end());
+  return v[idx];
+}
+
+#endif //IRIDIUM_SATELLITE_COMM_FLEET_SIM_H